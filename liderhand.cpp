@@ -130,8 +130,13 @@ LiderHand::ErrorStatus LiderHand::ParseDataFromLiderHand(std::string data)
 
     std::vector<uint8_t> decoded = b64_decode(data);
 
+    if(decoded.size() < 5) //header (4 bytes) + CRC
+    {
+        return ERROR;
+    }
+
     uint8_t CRC_Val = 0x00;
-    for(int i=0; i<decoded.size() - 1; i++)
+    for(size_t i=0; i<decoded.size() - 1; i++)
     {
         CRC_Val = CRC8_CCITT_Calc(CRC_Val, decoded[i]);
     }
@@ -141,10 +146,26 @@ LiderHand::ErrorStatus LiderHand::ParseDataFromLiderHand(std::string data)
         return ERROR;
     }
 
-    /*if((decoded[3] * 9 + 4) != (decoded.size() - 1)) //if packet size not valid
+    size_t payloadSize = decoded.size() - 1;
+    size_t checkPtr = 4;
+    for(int i=0; i<decoded[3]; i++) //if packet size not valid for declared driver and encoder counts
+    {
+        checkPtr += 7; //flags, PWM, PositionSet, Current
+        if(checkPtr + 1 > payloadSize)
+        {
+            return ERROR;
+        }
+        uint8_t encCount = decoded[checkPtr]; checkPtr++;
+        if(encCount > PositionCurrent_Count_Max)
+        {
+            return ERROR;
+        }
+        checkPtr += 2 * encCount;
+    }
+    if(checkPtr > payloadSize)
     {
         return ERROR;
-    }*/
+    }
 
     READ_SystemOperationMode = (SystemOperationMode_Type)decoded[0];
     READ_CalibrationProcedure = (CalibrationProcedure_Type)decoded[1];
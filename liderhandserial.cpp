@@ -0,0 +1,177 @@
+#include "liderhandserial.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+static bool BaudToSpeed(uint32_t baudRate, speed_t& speed)
+{
+    switch(baudRate)
+    {
+        case 9600:      speed = B9600;      return true;
+        case 19200:     speed = B19200;     return true;
+        case 38400:     speed = B38400;     return true;
+        case 57600:     speed = B57600;     return true;
+        case 115200:    speed = B115200;    return true;
+        case 230400:    speed = B230400;    return true;
+#ifdef B460800
+        case 460800:    speed = B460800;    return true;
+#endif
+#ifdef B921600
+        case 921600:    speed = B921600;    return true;
+#endif
+        default:        return false;
+    }
+}
+
+bool LiderHandSerial::Open(const std::string& portName, uint32_t baudRate)
+{
+    Close();
+
+    speed_t speed;
+    if(!BaudToSpeed(baudRate, speed))//rate not supported by this platform termios
+    {
+        errno = EINVAL;
+        return false;
+    }
+
+    fd = ::open(portName.c_str(), O_RDWR | O_NOCTTY);
+    if(fd < 0)
+    {
+        return false;
+    }
+
+    struct termios tty;
+    if(tcgetattr(fd, &tty) != 0)
+    {
+        int err = errno;
+        Close();
+        errno = err;
+        return false;
+    }
+
+    cfmakeraw(&tty);
+    tty.c_cflag |= CLOCAL | CREAD;
+    tty.c_cflag &= ~(CSTOPB | PARENB | CSIZE);
+    tty.c_cflag |= CS8;
+#ifdef CRTSCTS
+    tty.c_cflag &= ~CRTSCTS;
+#endif
+    tty.c_iflag &= ~(IXON | IXOFF | IXANY);
+    tty.c_cc[VMIN] = 1; //block until at least one byte is available
+    tty.c_cc[VTIME] = 0;
+
+    cfsetispeed(&tty, speed);
+    cfsetospeed(&tty, speed);
+
+    if(tcsetattr(fd, TCSANOW, &tty) != 0)
+    {
+        int err = errno;
+        Close();
+        errno = err;
+        return false;
+    }
+
+    tcflush(fd, TCIOFLUSH);
+    rxBuffer.clear();
+
+    return true;
+}
+
+void LiderHandSerial::Close()
+{
+    if(fd >= 0)
+    {
+        ::close(fd);
+        fd = -1;
+    }
+    rxBuffer.clear();
+}
+
+bool LiderHandSerial::Write(const std::string& data)
+{
+    if(fd < 0)
+    {
+        return false;
+    }
+
+    size_t written = 0;
+    while(written < data.length())
+    {
+        ssize_t n = ::write(fd, data.data() + written, data.length() - written);
+        if(n < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        written += n;
+    }
+
+    return true;
+}
+
+bool LiderHandSerial::Flush()
+{
+    if(fd < 0)
+    {
+        return false;
+    }
+
+    while(tcdrain(fd) != 0)
+    {
+        if(errno != EINTR)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool LiderHandSerial::ReadLine(std::string& line)
+{
+    if(fd < 0)
+    {
+        return false;
+    }
+
+    size_t searchFrom = 0;
+    while(1)
+    {
+        size_t pos = rxBuffer.find('\n', searchFrom);
+        if(pos != std::string::npos)
+        {
+            line.assign(rxBuffer, 0, pos + 1);
+            rxBuffer.erase(0, pos + 1);
+            return true;
+        }
+        if(rxBuffer.length() >= LIDERHANDSERIAL_RX_BUFFER_MAX)//no '\n' in sight, e.g. wrong baud rate or line noise
+        {
+            rxBuffer.clear();
+            errno = EMSGSIZE;
+            return false;
+        }
+        searchFrom = rxBuffer.length();
+
+        char buf[256];
+        ssize_t n = ::read(fd, buf, sizeof(buf));
+        if(n < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return false;
+        }
+        if(n == 0)//port closed / hangup
+        {
+            errno = EIO;
+            return false;
+        }
+        rxBuffer.append(buf, n);
+    }
+}
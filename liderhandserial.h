@@ -0,0 +1,36 @@
+#ifndef LIDERHANDSERIAL_H
+#define LIDERHANDSERIAL_H
+
+#include <stdint.h>
+#include <string>
+
+#define LIDERHANDSERIAL_RX_BUFFER_MAX       8192    //longest valid LiderHand line (255 drivers) is ~5.5 kB
+
+//POSIX (termios) serial transport for LiderHand, usable without Qt
+//port is configured as 8N1, no flow control, raw mode
+//default LiderHand rate (460800) requires B460800 to be defined by the platform termios (e.g. Linux)
+class LiderHandSerial
+{
+public:
+    LiderHandSerial() {}
+    ~LiderHandSerial()                                                  {Close();}
+
+    LiderHandSerial(const LiderHandSerial&) = delete;
+    LiderHandSerial& operator=(const LiderHandSerial&) = delete;
+
+public:
+    bool                        Open(const std::string& portName, uint32_t baudRate = 460800);     //on failure errno is set, EINVAL if baudRate is not supported by the platform
+    void                        Close();
+    bool                        IsOpen()                                {return fd >= 0;}
+
+    bool                        Write(const std::string& data);         //blocks until all data is passed to the driver, does not wait for transmission
+    bool                        Flush();                                //blocks until all written data is physically transmitted
+    bool                        ReadLine(std::string& line);            //blocks until '\n' terminated line is received, '\n' is kept
+                                                                        //on failure errno is set, EMSGSIZE if no '\n' within LIDERHANDSERIAL_RX_BUFFER_MAX bytes (buffer is dropped)
+
+private:
+    int                         fd = -1;
+    std::string                 rxBuffer;
+};
+
+#endif // LIDERHANDSERIAL_H
@@ -0,0 +1,140 @@
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+
+#include "liderhand.h"
+#include "liderhandserial.h"
+
+//------Qt-free variant of main.cpp, uses POSIX termios transport (LiderHandSerial)--//
+
+typedef enum
+{
+    IDLE,
+    INTERNAL,
+    EXTERNAL
+}Mode_Type;
+
+Mode_Type Mode;
+LiderHandSerial serial;
+LiderHand LiderHandObj;
+
+void usage()
+{
+    std::cout << "\tLiderHandCommTestPosix <serialport name> <mode>" << std::endl;
+    std::cout << "\t\t<serialport name> - name of the serial port eg. /dev/ttyUSB0" << std::endl;
+    std::cout << "\t\t<mode> - mode of operation, can be value of: IDLE | INTERNAL | EXTERNAL" << std::endl;
+    std::cout << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc != 3)
+    {
+        std::cout << "Wrong argument count" << std::endl << std::endl;
+        usage();
+        return 0;
+    }else
+    {
+        if(strcmp(argv[2], "IDLE") == 0)
+        {
+            Mode = IDLE;
+        }else if(strcmp(argv[2], "INTERNAL") == 0)
+        {
+            Mode = INTERNAL;
+        }else if(strcmp(argv[2], "EXTERNAL") == 0)
+        {
+            Mode = EXTERNAL;
+        }else
+        {
+            std::cout << "Wrong <mode> argument value" << std::endl << std::endl;
+            usage();
+            return 0;
+        }
+    }
+
+    if(!serial.Open(argv[1], 460800))//open serial port
+    {
+        std::cout << "Serial open fail: " << strerror(errno) << std::endl;
+        return 1;
+    }
+
+    std::cout << "Serial opened" << std::endl;
+
+    //------ENABLES LiderHand TO SEND STATUS UPDATED (100 Hz)-------------------------//
+    serial.Write(LiderHandObj.PrepareDataEnableStatusUpdate());
+
+    std::string data;
+    while(1)
+    {
+        if(!serial.ReadLine(data))//wait for new data - blocking, data is '\n' terminated
+        {
+            if(errno == EMSGSIZE)//no line terminator received, e.g. line noise - drop and continue
+            {
+                std::cout << "Read ERROR line too long" << std::endl;
+                continue;
+            }
+            break;
+        }
+
+        if(LiderHandObj.ParseDataFromLiderHand(data) == LiderHand::SUCCESS)
+        {
+            uint8_t count = LiderHandObj.GetMotorDriverCount();
+            std::cout << "Read SUCCESS Drv count = " << (int)count << std::endl;
+
+            LiderHand::CurrentError_Type error = LiderHandObj.GetCurrentError();
+            if(error != LiderHand::ERROR_OK)
+            {
+                std::cout << "LiderHand ERROR 0x" << std::hex << (int)error << std::dec << std::endl;
+            }
+
+            for(int i=0; i<count; i++)
+            {
+                if(LiderHandObj.GetMotorDriverOperation(i) == LiderHand::Operation_Fault)
+                {
+                    std::cout << "Motor " << i << " faulty" << std::endl;
+                }
+            }
+        }else
+        {
+            std::cout << "Read ERROR" << std::endl;
+        }
+
+        uint8_t DrvCount = LiderHandObj.GetMotorDriverCount();
+
+        //------see main.cpp for the description of each mode-----------------------------//
+        if(Mode == IDLE)
+        {
+            for(int i=0; i<DrvCount; i++)
+            {
+                LiderHandObj.SetFreeDrive(i, LiderHand::FreeDrive_DIS);
+            }
+            serial.Write(LiderHandObj.PrepareDataIdleMode());
+        }
+
+        if(Mode == INTERNAL)
+        {
+            for(int i=0; i<DrvCount; i++)
+            {
+                LiderHandObj.SetPosition(i, 30000); //set position of each drive here, range 1-65535
+            }
+            serial.Write(LiderHandObj.PrepareDataInternalRegMode());
+        }
+
+        if(Mode == EXTERNAL)
+        {
+            for(int i=0; i<DrvCount; i++)
+            {
+                //----IMPLEMENT YOUR REGULATOR HERE---//
+
+                LiderHandObj.SetPWM(i, 0); //PWM value, range 1-65535
+                LiderHandObj.SetFreeDrive(i, LiderHand::FreeDrive_DIS);
+                LiderHandObj.SetDirection(i, LiderHand::Dir_Positive);
+            }
+            serial.Write(LiderHandObj.PrepareDataExternalRegMode());
+        }
+    }
+
+    std::cout << "Serial read fail: " << strerror(errno) << std::endl;
+
+    return 1;
+}
@@ -0,0 +1,97 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "liderhand.h"
+#include "liderhand_frame.h"
+
+//------protocol core benchmark, no Qt and no serial port required--------------------//
+//------usage: liderhand_bench [iterations]-------------------------------------------//
+
+#define BENCH_DRIVER_COUNT      6
+#define BENCH_ENCODER_COUNT     2
+
+static volatile uint32_t Sink = 0; //keeps results observable to the optimizer
+
+template<typename F>
+static void Run(const char* name, long iterations, F func)
+{
+    auto start = std::chrono::steady_clock::now();
+    for(long i=0; i<iterations; i++)
+    {
+        func();
+    }
+    auto stop = std::chrono::steady_clock::now();
+
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    std::cout << name << ": " << iterations << " iterations, "
+              << ns / iterations << " ns/op" << std::endl;
+}
+
+int main(int argc, char *argv[])
+{
+    long iterations = 1000000;
+    if(argc > 1)
+    {
+        iterations = std::atol(argv[1]);
+        if(iterations <= 0)
+        {
+            std::cout << "Wrong iterations argument value" << std::endl;
+            return 1;
+        }
+    }
+
+    //------typical status frame, produced by the hand with every driver reporting------//
+    std::string statusFrame;
+    {
+        //status frame layout matches ParseDataFromLiderHand
+        std::vector<uint8_t> payload = {LiderHand::MODE_EXT_REGULATOR, LiderHand::CALIBRATION_Disabled, LiderHand::ERROR_OK, BENCH_DRIVER_COUNT};
+        for(int i=0; i<BENCH_DRIVER_COUNT; i++)
+        {
+            payload.push_back(LiderHand::Dir_Positive);
+            for(int b=0; b<6; b++)
+            {
+                payload.push_back((uint8_t)(i * 16 + b));
+            }
+            payload.push_back(BENCH_ENCODER_COUNT);
+            for(int b=0; b<2 * BENCH_ENCODER_COUNT; b++)
+            {
+                payload.push_back((uint8_t)(i + b));
+            }
+        }
+
+        statusFrame = MakeFrame(payload);
+    }
+
+    LiderHand hand;
+    if(hand.ParseDataFromLiderHand(statusFrame) != LiderHand::SUCCESS || hand.GetMotorDriverCount() != BENCH_DRIVER_COUNT)
+    {
+        std::cout << "Benchmark status frame rejected" << std::endl;
+        return 1;
+    }
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(__OPTIMIZE__)
+    std::cout << "WARNING: built without optimization, results are not representative (use -DCMAKE_BUILD_TYPE=Release)" << std::endl;
+#endif
+
+    std::cout << "Drivers: " << BENCH_DRIVER_COUNT << ", encoders per driver: " << BENCH_ENCODER_COUNT
+              << ", status frame: " << statusFrame.length() << " bytes" << std::endl;
+
+    Run("ParseDataFromLiderHand", iterations, [&]()
+    {
+        Sink += hand.ParseDataFromLiderHand(statusFrame);
+    });
+
+    Run("PrepareDataExternalRegMode", iterations, [&]()
+    {
+        for(int i=0; i<BENCH_DRIVER_COUNT; i++)
+        {
+            hand.SetPWM(i, (uint16_t)(Sink + i));
+        }
+        Sink += hand.PrepareDataExternalRegMode().length();
+    });
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#ifndef LIDERHAND_FRAME_H
+#define LIDERHAND_FRAME_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//------frame helpers (base64 + CRC8 CCITT) shared by liderhand_test and liderhand_bench--//
+//------written independently of liderhand.cpp so the test does not reuse library code--//
+
+static const char B64_Chr[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+inline uint8_t Crc8(const std::vector<uint8_t>& data, size_t len)
+{
+    uint8_t crc = 0x00;
+    for(size_t i=0; i<len; i++)
+    {
+        crc ^= data[i];
+        for(int b=0; b<8; b++)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+inline std::string Base64Encode(const std::vector<uint8_t>& in)
+{
+    std::string out;
+    for(size_t i=0; i<in.size(); i+=3)
+    {
+        uint32_t v = in[i] << 16;
+        if(i+1 < in.size()) v |= in[i+1] << 8;
+        if(i+2 < in.size()) v |= in[i+2];
+        out += B64_Chr[(v >> 18) & 0x3F];
+        out += B64_Chr[(v >> 12) & 0x3F];
+        out += (i+1 < in.size()) ? B64_Chr[(v >> 6) & 0x3F] : '=';
+        out += (i+2 < in.size()) ? B64_Chr[v & 0x3F] : '=';
+    }
+    return out;
+}
+
+inline bool Base64Decode(const std::string& in, std::vector<uint8_t>& out)
+{
+    out.clear();
+    if(in.length() % 4 != 0)
+    {
+        return false;
+    }
+    std::string chr(B64_Chr);
+    for(size_t i=0; i<in.length(); i+=4)
+    {
+        uint32_t v = 0;
+        int pad = 0;
+        for(int k=0; k<4; k++)
+        {
+            v <<= 6;
+            if(in[i+k] == '=')
+            {
+                pad++;
+                continue;
+            }
+            size_t pos = chr.find(in[i+k]);
+            if(pos == std::string::npos)
+            {
+                return false;
+            }
+            v |= pos;
+        }
+        out.push_back((v >> 16) & 0xFF);
+        if(pad < 2) out.push_back((v >> 8) & 0xFF);
+        if(pad < 1) out.push_back(v & 0xFF);
+    }
+    return true;
+}
+
+inline std::string MakeFrame(std::vector<uint8_t> payload)
+{
+    payload.push_back(Crc8(payload, payload.size()));
+    return Base64Encode(payload) + "\n";
+}
+
+//checks base64 + CRC8 + trailing '\n' and returns payload without CRC
+inline bool DecodeFrame(const std::string& frame, std::vector<uint8_t>& payload)
+{
+    if(frame.empty() || frame[frame.length()-1] != '\n')
+    {
+        return false;
+    }
+    if(!Base64Decode(frame.substr(0, frame.length()-1), payload) || payload.empty())
+    {
+        return false;
+    }
+    uint8_t crc = payload.back();
+    payload.pop_back();
+    return Crc8(payload, payload.size()) == crc;
+}
+
+inline void PushU16(std::vector<uint8_t>& data, uint16_t val)
+{
+    data.push_back(val & 0xFF);
+    data.push_back(val >> 8);
+}
+
+#endif // LIDERHAND_FRAME_H
@@ -0,0 +1,189 @@
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "liderhand.h"
+#include "liderhand_frame.h"
+
+//------protocol core test, no Qt and no serial port required------------------------//
+
+static int Failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if(!(cond)) \
+        { \
+            std::cout << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #cond << std::endl; \
+            Failures++; \
+        } \
+    } while(0)
+
+//------tests-------------------------------------------------------------------------//
+
+static void TestCommandFrames()
+{
+    LiderHand hand;
+    std::vector<uint8_t> payload;
+
+    CHECK(DecodeFrame(hand.PrepareDataEnableStatusUpdate(), payload));
+    CHECK(payload == std::vector<uint8_t>({0x01}));
+    CHECK(DecodeFrame(hand.PrepareDataDisableStatusUpdate(), payload));
+    CHECK(payload == std::vector<uint8_t>({0x02}));
+    CHECK(DecodeFrame(hand.PrepareDataPerformCalibration(), payload));
+    CHECK(payload == std::vector<uint8_t>({0x03}));
+    CHECK(DecodeFrame(hand.PrepareDataResetErrors(), payload));
+    CHECK(payload == std::vector<uint8_t>({0x04}));
+}
+
+static void TestModeFrames()
+{
+    LiderHand hand;
+    hand.DummyInit(2);
+    std::vector<uint8_t> payload;
+
+    hand.SetFreeDrive(0, LiderHand::FreeDrive_EN);
+    hand.SetFreeDrive(1, LiderHand::FreeDrive_DIS);
+    CHECK(DecodeFrame(hand.PrepareDataIdleMode(), payload));
+    CHECK(payload == std::vector<uint8_t>({0x05, 2, 0x01, 0x00}));
+
+    hand.SetPosition(0, 0x1234);
+    hand.SetPosition(1, 0xABCD);
+    CHECK(DecodeFrame(hand.PrepareDataInternalRegMode(), payload));
+    CHECK(payload == std::vector<uint8_t>({0x06, 2, 0x34, 0x12, 0xCD, 0xAB}));
+
+    hand.SetPWM(0, 0x0102);
+    hand.SetPWM(1, 0xF00F);
+    hand.SetDirection(0, LiderHand::Dir_Positive);
+    hand.SetDirection(1, LiderHand::Dir_Negative);
+    CHECK(DecodeFrame(hand.PrepareDataExternalRegMode(), payload));
+    CHECK(payload == std::vector<uint8_t>({0x07, 2, 0x03, 0x02, 0x01, 0x00, 0x0F, 0xF0}));
+
+    CHECK(!hand.SetPWM(2, 0));
+}
+
+static std::vector<uint8_t> MakeStatusPayload()
+{
+    std::vector<uint8_t> data;
+    data.push_back(LiderHand::MODE_EXT_REGULATOR);
+    data.push_back(LiderHand::CALIBRATION_Disabled);
+    data.push_back(LiderHand::ERROR_MOTOR_FAULT);
+    data.push_back(2); //driver count
+
+    data.push_back(LiderHand::FreeDrive_EN | LiderHand::Dir_Positive);
+    PushU16(data, 1000);    //PWM
+    PushU16(data, 30000);   //PositionSet
+    PushU16(data, 250);     //Current
+    data.push_back(1);      //encoder count
+    PushU16(data, 12345);
+
+    data.push_back(LiderHand::Operation_Fault);
+    PushU16(data, 65535);
+    PushU16(data, 1);
+    PushU16(data, 4000);
+    data.push_back(3);
+    PushU16(data, 10);
+    PushU16(data, 20);
+    PushU16(data, 30);
+
+    return data;
+}
+
+static void TestParseStatus()
+{
+    LiderHand hand;
+    CHECK(hand.ParseDataFromLiderHand(MakeFrame(MakeStatusPayload())) == LiderHand::SUCCESS);
+
+    CHECK(hand.GetSystemOperationMode() == LiderHand::MODE_EXT_REGULATOR);
+    CHECK(hand.GetCalibrationProcedure() == LiderHand::CALIBRATION_Disabled);
+    CHECK(hand.GetCurrentError() == LiderHand::ERROR_MOTOR_FAULT);
+    CHECK(hand.GetMotorDriverCount() == 2);
+
+    CHECK(hand.GetFreeDrive(0) == LiderHand::FreeDrive_EN);
+    CHECK(hand.GetDirection(0) == LiderHand::Dir_Positive);
+    CHECK(hand.GetMotorDriverOperation(0) == LiderHand::Operation_OK);
+    CHECK(hand.GetPWM(0) == 1000);
+    CHECK(hand.GetPositonSet(0) == 30000);
+    CHECK(hand.GetCurrent(0) == 250);
+    CHECK(hand.GetPositonCurrent_Count(0) == 1);
+    CHECK(hand.GetPositonCurrent(0, 0) == 12345);
+
+    CHECK(hand.GetFreeDrive(1) == LiderHand::FreeDrive_DIS);
+    CHECK(hand.GetDirection(1) == LiderHand::Dir_Negative);
+    CHECK(hand.GetMotorDriverOperation(1) == LiderHand::Operation_Fault);
+    CHECK(hand.GetPWM(1) == 65535);
+    CHECK(hand.GetCurrent(1) == 4000);
+    CHECK(hand.GetPositonCurrent_Count(1) == 3);
+    CHECK(hand.GetPositonCurrent(1, 0) == 10);
+    CHECK(hand.GetPositonCurrent(1, 2) == 30);
+    CHECK(hand.GetPositonCurrent(1, 3) == 0);
+
+    CHECK(hand.GetPWM(2) == 0);
+    CHECK(hand.GetDirection(2) == LiderHand::Dir_Invalid);
+}
+
+static void TestParseMalformed()
+{
+    LiderHand hand;
+    CHECK(hand.ParseDataFromLiderHand(MakeFrame(MakeStatusPayload())) == LiderHand::SUCCESS);
+
+    CHECK(hand.ParseDataFromLiderHand("") == LiderHand::ERROR);
+    CHECK(hand.ParseDataFromLiderHand("\n") == LiderHand::ERROR);
+    CHECK(hand.ParseDataFromLiderHand("A\n") == LiderHand::ERROR);
+    CHECK(hand.ParseDataFromLiderHand("AA==\n") == LiderHand::ERROR);
+    CHECK(hand.ParseDataFromLiderHand("!!!!\n") == LiderHand::ERROR);
+
+    //corrupted CRC
+    std::vector<uint8_t> payload = MakeStatusPayload();
+    payload.push_back(Crc8(payload, payload.size()) ^ 0xFF);
+    CHECK(hand.ParseDataFromLiderHand(Base64Encode(payload) + "\n") == LiderHand::ERROR);
+
+    //truncated frame with valid CRC
+    payload = MakeStatusPayload();
+    payload.resize(payload.size() - 3);
+    CHECK(hand.ParseDataFromLiderHand(MakeFrame(payload)) == LiderHand::ERROR);
+
+    //header only, but drivers declared
+    payload = std::vector<uint8_t>({0x00, 0x00, 0x00, 4});
+    CHECK(hand.ParseDataFromLiderHand(MakeFrame(payload)) == LiderHand::ERROR);
+
+    //encoder count above PositionCurrent_Count_Max
+    payload = std::vector<uint8_t>({0x00, 0x00, 0x00, 1, 0, 0, 0, 0, 0, 0, 0, 5});
+    for(int i=0; i<5; i++) PushU16(payload, 0);
+    CHECK(hand.ParseDataFromLiderHand(MakeFrame(payload)) == LiderHand::ERROR);
+
+    //rejected frames do not modify previously parsed state
+    CHECK(hand.GetSystemOperationMode() == LiderHand::MODE_EXT_REGULATOR);
+    CHECK(hand.GetCurrentError() == LiderHand::ERROR_MOTOR_FAULT);
+    CHECK(hand.GetMotorDriverCount() == 2);
+    CHECK(hand.GetPWM(0) == 1000);
+    CHECK(hand.GetCurrent(0) == 250);
+    CHECK(hand.GetPositonCurrent_Count(0) == 1);
+    CHECK(hand.GetPositonCurrent(0, 0) == 12345);
+    CHECK(hand.GetPWM(1) == 65535);
+    CHECK(hand.GetCurrent(1) == 4000);
+    CHECK(hand.GetPositonCurrent_Count(1) == 3);
+    CHECK(hand.GetPositonCurrent(1, 0) == 10);
+    CHECK(hand.GetPositonCurrent(1, 2) == 30);
+
+    //no drivers is a valid status frame
+    payload = std::vector<uint8_t>({0x00, 0x00, 0x00, 0});
+    CHECK(hand.ParseDataFromLiderHand(MakeFrame(payload)) == LiderHand::SUCCESS);
+    CHECK(hand.GetMotorDriverCount() == 0);
+}
+
+int main()
+{
+    TestCommandFrames();
+    TestModeFrames();
+    TestParseStatus();
+    TestParseMalformed();
+
+    if(Failures != 0)
+    {
+        std::cout << Failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}
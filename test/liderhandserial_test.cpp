@@ -0,0 +1,127 @@
+#include <chrono>
+#include <errno.h>
+#include <fcntl.h>
+#include <iostream>
+#include <stdlib.h>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "liderhandserial.h"
+#include "liderhand_frame.h"
+
+//------LiderHandSerial::ReadLine test over a pseudo terminal, Linux only------------//
+
+static int Failures = 0;
+
+#define CHECK(cond) \
+    do { \
+        if(!(cond)) \
+        { \
+            std::cout << __FILE__ << ":" << __LINE__ << ": CHECK failed: " #cond << std::endl; \
+            Failures++; \
+        } \
+    } while(0)
+
+static void WriteAll(int fd, const std::string& data)
+{
+    size_t written = 0;
+    while(written < data.length())
+    {
+        ssize_t n = ::write(fd, data.data() + written, data.length() - written);
+        if(n < 0)
+        {
+            if(errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+        written += n;
+    }
+}
+
+static void Pause()
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+}
+
+int main()
+{
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if(master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        std::cout << "posix_openpt failed" << std::endl;
+        return 1;
+    }
+
+    LiderHandSerial serial;
+    if(!serial.Open(ptsname(master)))
+    {
+        std::cout << "LiderHandSerial::Open failed on " << ptsname(master) << std::endl;
+        return 1;
+    }
+
+    std::string frameA = MakeFrame({0x01, 0x02, 0x03, 0x00});
+    std::string frameB = MakeFrame({0x02, 0x00, 0x04, 0x00});
+    std::string frameC = MakeFrame({0x00, 0x01, 0x00, 0x00});
+    std::string garbage(LIDERHANDSERIAL_RX_BUFFER_MAX + 100, 'A');
+
+    std::thread writer([&]()
+    {
+        //two lines in one write
+        WriteAll(master, frameA + frameB);
+        Pause();
+
+        //one line split across several writes
+        WriteAll(master, frameC.substr(0, 3));
+        Pause();
+        WriteAll(master, frameC.substr(3, 2));
+        Pause();
+        WriteAll(master, frameC.substr(5));
+        Pause();
+
+        //end of one line and start of the next in the same write
+        WriteAll(master, frameA.substr(0, 4));
+        Pause();
+        WriteAll(master, frameA.substr(4) + frameB.substr(0, 2));
+        Pause();
+        WriteAll(master, frameB.substr(2));
+        Pause();
+
+        //no line terminator for longer than the buffer limit, then valid lines
+        WriteAll(master, garbage);
+        Pause();
+        WriteAll(master, "\n" + frameC);
+    });
+
+    std::string line;
+
+    CHECK(serial.ReadLine(line) && line == frameA);
+    CHECK(serial.ReadLine(line) && line == frameB);
+    CHECK(serial.ReadLine(line) && line == frameC);
+    CHECK(serial.ReadLine(line) && line == frameA);
+    CHECK(serial.ReadLine(line) && line == frameB);
+
+    errno = 0;
+    CHECK(!serial.ReadLine(line));
+    CHECK(errno == EMSGSIZE);
+
+    //remainder of the dropped garbage is returned as one (invalid) line, then reading resynchronises
+    CHECK(serial.ReadLine(line) && line.length() < garbage.length() && line[line.length()-1] == '\n');
+    CHECK(serial.ReadLine(line) && line == frameC);
+
+    writer.join();
+    serial.Close();
+    ::close(master);
+
+    if(Failures != 0)
+    {
+        std::cout << Failures << " check(s) failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "All checks passed" << std::endl;
+    return 0;
+}